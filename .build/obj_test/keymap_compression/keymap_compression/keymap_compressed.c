@@ -0,0 +1,46 @@
+/* Generated by util/keymap_compress.c, do not edit.
+ * 4 layers of 4x12 keys, 384 bytes compressed to 228 bytes.
+ */
+
+#include "keymap_compression.h"
+
+_Static_assert(MATRIX_ROWS == 4 && MATRIX_COLS == 12, "the keymap was compressed with a different matrix size");
+
+const uint8_t keymap_compressed_layer_count = 4;
+
+const uint16_t PROGMEM keymap_compressed_fill[] = {
+    0x002C,
+    0x0001,
+    0x0001,
+    0x0000,
+};
+
+const matrix_row_t PROGMEM keymap_compressed_mask[][MATRIX_ROWS] = {
+    {0x0FFF, 0x0FFF, 0x0FFF, 0x0F9F},
+    {0x0FFF, 0x0F80, 0x0000, 0x0F00},
+    {0x07FE, 0x0000, 0x0000, 0x0800},
+    {0x0000, 0x0000, 0x0000, 0x0000},
+};
+
+const uint16_t PROGMEM keymap_compressed_start[][MATRIX_ROWS] = {
+    {0, 12, 24, 36},
+    {46, 58, 63, 63},
+    {67, 77, 77, 77},
+    {78, 78, 78, 78},
+};
+
+const uint16_t PROGMEM keymap_compressed_keycodes[] = {
+    // layer 0
+    0x0029, 0x0014, 0x001A, 0x0008, 0x0015, 0x0017, 0x001C, 0x0018, 0x000C, 0x0012, 0x0013, 0x002A,
+    0x002B, 0x0004, 0x0016, 0x0007, 0x0009, 0x000A, 0x000B, 0x000D, 0x000E, 0x000F, 0x0033, 0x0034,
+    0x00E1, 0x001D, 0x001B, 0x0006, 0x0019, 0x0005, 0x0011, 0x0010, 0x0036, 0x0037, 0x0038, 0x0028,
+    0x0000, 0x00E0, 0x00E2, 0x00E3, 0x5101, 0x5102, 0x0050, 0x0051, 0x0052, 0x004F,
+    // layer 1
+    0x0035, 0x001E, 0x001F, 0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x004C,
+    0x002D, 0x002E, 0x002F, 0x0030, 0x0031,
+    0x004A, 0x004E, 0x004B, 0x004D,
+    // layer 2
+    0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, 0x0040, 0x0041, 0x0042, 0x0043,
+    0x5C00,
+    // layer 3
+};